@@ -118,6 +118,10 @@ class LIBCXX_HIDDEN impldocObj : public docObj, public get_localeObj {
 	ref<writelockObj> writelock() override;
 };
 
+// Parse a list of XML_PARSE_ options, see xml::parser::create()
+
+int parse_options(const std::string_view &options) LIBCXX_HIDDEN;
+
 // Implement xml::parser
 
 class LIBCXX_HIDDEN implparserObj : public parserObj {